@@ -8,6 +8,7 @@
 import UIKit
 import CoreData
 import IQKeyboardManagerSwift
+import RealmSwift
 
 @main
 class AppDelegate: UIResponder, UIApplicationDelegate {
@@ -18,6 +19,18 @@ class AppDelegate: UIResponder, UIApplicationDelegate {
         // Override point for customization after application launch.
         IQKeyboardManager.shared.enable = true
         UserDefaults.standard.set(true, forKey: "engTrueArabicFalse")
+        var realmConfig = Realm.Configuration.defaultConfiguration
+        // Only ArticleTable is persisted, skip schema discovery of every Object subclass
+        realmConfig.objectTypes = [ArticleTable.self]
+        // v1: ArticleTable keyed by url, per-save tracking id column removed
+        realmConfig.schemaVersion = 1
+        realmConfig.migrationBlock = { migration, oldSchemaVersion in
+            if oldSchemaVersion < 1 {
+                // Old rows hold duplicate urls, drop the offline cache so the new key is unique
+                migration.deleteData(forType: ArticleTable.className())
+            }
+        }
+        Realm.Configuration.defaultConfiguration = realmConfig
 //        window?.overrideUserInterfaceStyle = .dark
 //        KeyChainWrapper.Delete(key: "UserId")
         return true
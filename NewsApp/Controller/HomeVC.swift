@@ -24,6 +24,8 @@ class HomeVC: BaseViewController {
     private var isCountrySelected = false
     private var status = ""
     private var totalResults = 0
+    // Next stored row to page in, nil when the list came from the api
+    private var offlineOffset: Int?
     var isLoaded = false
     var selected: String {
         return AppUserDefaults.string(forKey: "selectedNews") ?? ""
@@ -63,11 +65,9 @@ class HomeVC: BaseViewController {
         if (InternetReachability.sharedInstance.isInternetAvailable()) {
             HomeNews_Api(page: Global.page, isRefresh: false, category: "", country: Global.country)
         } else {
-            for i in fetchArticleTableData(){
-                let src: HomeBaseMDL.HomeData.Source = HomeBaseMDL.HomeData.Source(id: i.sourceId, name: i.sourceName)
-                let arr = HomeBaseMDL.HomeData(source: src, author: i.author, title: i.title, description: i.description, url: i.url, urlToImage: i.urlToImage, publishedAt: i.publishedAt, content: i.content)
-                arrayNews.append(arr)
-            }
+            arrayNews.removeAll()
+            offlineOffset = 0
+            loadOfflineArticles()
             self.isLoaded = true
             tableview.reloadData()
         }
@@ -97,11 +97,9 @@ class HomeVC: BaseViewController {
             HomeNews_Api(page: Global.page, isRefresh: true, category: Global.category, country: Global.country)
             
         }else {
-            for i in fetchArticleTableData(){
-                let src: HomeBaseMDL.HomeData.Source = HomeBaseMDL.HomeData.Source(id: i.sourceId, name: i.sourceName)
-                let arr = HomeBaseMDL.HomeData(source: src, author: i.author, title: i.title, description: i.description, url: i.url, urlToImage: i.urlToImage, publishedAt: i.publishedAt, content: i.content)
-                arrayNews.append(arr)
-            }
+            arrayNews.removeAll()
+            offlineOffset = 0
+            loadOfflineArticles()
             tableview.reloadData()
         }
         self.pullControl.endRefreshing()
@@ -149,7 +147,15 @@ extension HomeVC: UITableViewDelegate, UITableViewDataSource {
                     HomeNews_Api(page:Global.page, isRefresh: false, category: Global.category, country: Global.country)
                 }
             }else {
-                
+                if offlineOffset != nil && indexPath.row == (arrayNews.count) - 1 {
+                    let count = arrayNews.count
+                    DispatchQueue.main.async {
+                        // Skip if the list changed before this ran
+                        if self.arrayNews.count == count && self.loadOfflineArticles() {
+                            tableView.reloadData()
+                        }
+                    }
+                }
             }
             
         } else {
@@ -215,6 +221,7 @@ extension HomeVC {
     func HomeNews_Api(page:Int, isRefresh:Bool, category:String, country:String)
     {
         
+        offlineOffset = nil
         let Req = Home.Request(page: page, category: category, country: country)
         objHomeVM.hitHomeMethod(request: Req, viewCont: self){ [self] in
             print("All Ok Data")
@@ -222,15 +229,17 @@ extension HomeVC {
                 arrayNews.removeAll()
             }
             if objHomeVM.HomeMdl?.status == "ok" {
-                if (objHomeVM.HomeMdl?.articles) != nil {
+                if let articles = objHomeVM.HomeMdl?.articles {
+                    let status = objHomeVM.HomeMdl?.status ?? ""
+                    let totalResults = objHomeVM.HomeMdl?.totalResults ?? 0
                     // MARK: -  Save News Artciles localally in background mode
                     DispatchQueue.background(background: {
-                        self.saveArticleTableData(arr: self.arrayNews)
+                        saveArticleDataList(arr: articles, status: status, totalResults: totalResults)
                     }, completion:{
-                        self.status = self.objHomeVM.HomeMdl?.status ?? ""
-                        self.totalResults = self.objHomeVM.HomeMdl?.totalResults ?? 0
+                        self.status = status
+                        self.totalResults = totalResults
                         
-                        for i in self.objHomeVM.HomeMdl!.articles!{
+                        for i in articles{
                             self.arrayNews.append(i)
                         }
                         self.isLoaded = true
@@ -333,18 +342,17 @@ extension HomeVC: ToolbarPickerViewDelegate {
     }
 }
 extension HomeVC {
-    // Save Partner List Into Local DB
-    func saveArticleTableData(arr: [HomeBaseMDL.HomeData]) {
-//        deletePartnertableData()
-        
-        var pIncr: Int  = 0
-        
-        let articleDataList = arr
-        if articleDataList.count > 0 {
-            for articleDetails in articleDataList {
-                pIncr += 1
-                saveArticleData(id:  getTrackingId(screenName: "\(pIncr)"), sourceId: articleDetails.source?.id ?? "", status: self.status, totalResults: self.totalResults ,sourceName: articleDetails.source?.name ?? "", author: articleDetails.author ?? "", title: articleDetails.title ?? "", Description: articleDetails.description ?? "", url: articleDetails.url ?? "", urlToImage: articleDetails.urlToImage ?? "", publishedAt: articleDetails.publishedAt ?? "", content: articleDetails.content ?? "")
-            }
+    // Load next page of stored articles while offline, returns false when nothing is left
+    @discardableResult
+    func loadOfflineArticles() -> Bool {
+        guard let offset = offlineOffset else { return false }
+        let page = fetchArticleTablePage(offset: offset, limit: Global.offlinePageSize)
+        offlineOffset = offset + page.count
+        for i in page {
+            let src: HomeBaseMDL.HomeData.Source = HomeBaseMDL.HomeData.Source(id: i.sourceId, name: i.sourceName)
+            let arr = HomeBaseMDL.HomeData(source: src, author: i.author, title: i.title, description: i.Description, url: i.url, urlToImage: i.urlToImage, publishedAt: i.publishedAt, content: i.content)
+            arrayNews.append(arr)
         }
+        return !page.isEmpty
     }
 }
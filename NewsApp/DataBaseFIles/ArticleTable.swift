@@ -10,13 +10,12 @@ import RealmSwift
 
 class ArticleTable: Object {
     
-    // Primary Key Declaration
+    // Primary Key Declaration, url is stable across api pages and refreshes
     override static func primaryKey() -> String {
-        return "id"
+        return "url"
     }
     //
     
-    @objc dynamic var id = ""
     @objc dynamic var status = ""
     @objc dynamic var totalResults = 0
     @objc dynamic var author = ""
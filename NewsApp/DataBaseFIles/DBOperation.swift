@@ -23,24 +23,30 @@ func deletePartnertableData() {
     } catch { print("error is: \(error)")}
 }
 
-// -----------------Save partner List Data ----------------
+// -----------------Save Article List Data ----------------
 
-func saveArticleData(id: String, sourceId: String, status: String, totalResults: Int, sourceName: String, author: String, title: String, Description: String, url: String, urlToImage: String, publishedAt: String, content: String ) {
-    guard let realm = try? Realm() else { return }
-    let partnerData = ArticleTable()
-    partnerData.id = id
-    partnerData.status = status
-    partnerData.totalResults = totalResults
-    partnerData.sourceId = sourceId
-    partnerData.sourceName = sourceName
-    partnerData.author = author
-    partnerData.title = title
-    partnerData.Description = Description
-    partnerData.url = url
-    partnerData.urlToImage = urlToImage
-        partnerData.publishedAt = publishedAt
-        partnerData.content = content
-    do {   try realm.write {realm.add(partnerData, update: .all)}
+func saveArticleDataList(arr: [HomeBaseMDL.HomeData], status: String, totalResults: Int) {
+    guard !arr.isEmpty, let realm = try? Realm() else { return }
+    var articles = [ArticleTable]()
+    for articleDetails in arr {
+        // url is the primary key, articles without one can't be upserted
+        guard let url = articleDetails.url, !url.isEmpty else { continue }
+        let partnerData = ArticleTable()
+        partnerData.status = status
+        partnerData.totalResults = totalResults
+        partnerData.sourceId = articleDetails.source?.id ?? ""
+        partnerData.sourceName = articleDetails.source?.name ?? ""
+        partnerData.author = articleDetails.author ?? ""
+        partnerData.title = articleDetails.title ?? ""
+        partnerData.Description = articleDetails.description ?? ""
+        partnerData.url = url
+        partnerData.urlToImage = articleDetails.urlToImage ?? ""
+        partnerData.publishedAt = articleDetails.publishedAt ?? ""
+        partnerData.content = articleDetails.content ?? ""
+        articles.append(partnerData)
+    }
+    // Single write transaction for the fetched page
+    do {   try realm.write {realm.add(articles, update: .modified)}
     } catch {
         print("error is: \(error)")
         
@@ -59,11 +65,11 @@ func fetchArticleTableData() -> Results<ArticleTable>! {
     return dbfetchPartnerTableData
 }
 
-func  getTrackingId(screenName: String) -> String {
-    guard let version = Bundle.main.infoDictionary!["CFBundleVersion"]! as? String else { return ""}
-    let currentDate = Date()
-    let dateFormatter = DateFormatter()
-    dateFormatter.dateFormat = "MMddyyyyhhmmss"
-    let convertedDate: String = dateFormatter.string(from: currentDate)
-    return "\(screenName)\(convertedDate)\("_")\(version)"
+// -----------------Fetch Article List Page ----------------
+
+func fetchArticleTablePage(offset: Int, limit: Int) -> [ArticleTable] {
+    // Unsorted results have no stable order, page newest first like the online feed
+    guard let articles = fetchArticleTableData()?.sorted(byKeyPath: "publishedAt", ascending: false), offset < articles.count else { return [] }
+    let end = min(offset + limit, articles.count)
+    return Array(articles[offset..<end])
 }
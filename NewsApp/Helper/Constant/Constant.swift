@@ -28,6 +28,7 @@ class Global {
     static var category = ""
     static var country = "in"
     static var page = 1
+    static let offlinePageSize = 20
     static var selectCount = 0
 }
 